@@ -4,9 +4,32 @@
 #include <cstdlib>
 #include <ctime>
 #include <algorithm>
+#include <sys/resource.h>
 
 using namespace std;
 
+// Пиковый объём резидентной памяти процесса (КБ)
+long peak_rss_kb() {
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+// Вывод пикового объёма резидентной памяти каждого процесса
+void report_peak_rss(int rank, int size) {
+    long rss = peak_rss_kb();
+    vector<long> all_rss(size);
+    MPI_Gather(&rss, 1, MPI_LONG, all_rss.data(), 1, MPI_LONG, 0, MPI_COMM_WORLD);
+
+    if (rank == 0) {
+        cout << "\nRank | Peak RSS (MB)\n";
+        cout << "--------------------\n";
+        for (int i = 0; i < size; ++i) {
+            cout << i << "    | " << all_rss[i] / 1024.0 << "\n";
+        }
+    }
+}
+
 int main(int argc, char** argv) {
     MPI_Init(&argc, &argv);
 
@@ -14,6 +37,15 @@ int main(int argc, char** argv) {
     MPI_Comm_rank(MPI_COMM_WORLD, &rank); // Получение текущего ранга процесса
     MPI_Comm_size(MPI_COMM_WORLD, &size); // Получение общего числа процессов
     vector<int> vector_sizes = {1000, 10000, 100000, 1000000, 10000000};
+    int max_N = *max_element(vector_sizes.begin(), vector_sizes.end());
+
+    // Буферы выделяются один раз под максимальный размер и переиспользуются;
+    // полный вектор нужен только процессу 0
+    vector<int> data, local_data;
+    local_data.reserve(max_N / size);
+    if (rank == 0) {
+        data.reserve(max_N);
+    }
 
     if (rank == 0) {
         cout << "Vector Size | Number of Processes | Sequential Time | Parallel Time | Min | Max\n";
@@ -22,9 +54,8 @@ int main(int argc, char** argv) {
 
     // Проходим по каждому размеру вектора
     for (int N : vector_sizes) {
-        vector<int> data;
         int local_size = N / size;
-        vector<int> local_data(local_size);
+        local_data.resize(local_size);
         double seq_start_time = 0.0, seq_end_time = 0.0;
 
         // Генерация данных и последовательное выполнение на нулевом процессе
@@ -72,6 +103,8 @@ int main(int argc, char** argv) {
         }
     }
 
+    report_peak_rss(rank, size);
+
     MPI_Finalize();
     return 0;
 }
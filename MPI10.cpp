@@ -0,0 +1,270 @@
+#include <mpi.h>
+#include <iostream>
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <ctime>
+#include <cmath>
+#include <algorithm>
+#include <numeric>
+#include <limits>
+
+using namespace std;
+
+constexpr int REPETITIONS = 3; // Число повторов замера, берётся минимальное время
+
+// Разбиение N элементов на блоки по процессам коммуникатора (с учётом остатка)
+void block_partition(int N, int size, int unit, vector<int>& counts, vector<int>& displs) {
+    counts.assign(size, 0);
+    displs.assign(size, 0);
+    for (int i = 0; i < size; ++i) {
+        counts[i] = (N / size + (i < N % size ? 1 : 0)) * unit;
+        displs[i] = i > 0 ? displs[i - 1] + counts[i - 1] : 0;
+    }
+}
+
+// Поиск минимума и максимума вектора (ядро MPI1)
+double kernel_minmax(int N, MPI_Comm comm) {
+    int rank, size;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+
+    vector<int> counts, displs;
+    block_partition(N, size, 1, counts, displs);
+
+    vector<int> data;
+    vector<int> local_data(counts[rank]);
+    if (rank == 0) {
+        data.resize(N);
+        for (int i = 0; i < N; ++i) {
+            data[i] = rand() % 1000;
+        }
+    }
+
+    MPI_Barrier(comm);
+    double start_time = MPI_Wtime();
+
+    MPI_Scatterv(data.data(), counts.data(), displs.data(), MPI_INT,
+                 local_data.data(), counts[rank], MPI_INT, 0, comm);
+
+    int local_min = numeric_limits<int>::max();
+    int local_max = numeric_limits<int>::min();
+    if (!local_data.empty()) {
+        local_min = *min_element(local_data.begin(), local_data.end());
+        local_max = *max_element(local_data.begin(), local_data.end());
+    }
+
+    int global_min, global_max;
+    MPI_Reduce(&local_min, &global_min, 1, MPI_INT, MPI_MIN, 0, comm);
+    MPI_Reduce(&local_max, &global_max, 1, MPI_INT, MPI_MAX, 0, comm);
+
+    return MPI_Wtime() - start_time;
+}
+
+// Скалярное произведение векторов (ядро MPI2)
+double kernel_dot(int N, MPI_Comm comm) {
+    int rank, size;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+
+    vector<int> counts, displs;
+    block_partition(N, size, 1, counts, displs);
+
+    vector<int> vec1, vec2;
+    vector<int> local_vec1(counts[rank]), local_vec2(counts[rank]);
+    if (rank == 0) {
+        vec1.resize(N);
+        vec2.resize(N);
+        for (int i = 0; i < N; ++i) {
+            vec1[i] = rand() % 100;
+            vec2[i] = rand() % 100;
+        }
+    }
+
+    MPI_Barrier(comm);
+    double start_time = MPI_Wtime();
+
+    MPI_Scatterv(vec1.data(), counts.data(), displs.data(), MPI_INT,
+                 local_vec1.data(), counts[rank], MPI_INT, 0, comm);
+    MPI_Scatterv(vec2.data(), counts.data(), displs.data(), MPI_INT,
+                 local_vec2.data(), counts[rank], MPI_INT, 0, comm);
+
+    long long local_result = inner_product(local_vec1.begin(), local_vec1.end(), local_vec2.begin(), 0LL);
+    long long global_result = 0;
+    MPI_Reduce(&local_result, &global_result, 1, MPI_LONG_LONG, MPI_SUM, 0, comm);
+
+    return MPI_Wtime() - start_time;
+}
+
+// Умножение матриц по строкам (ядро MPI4)
+double kernel_matmul(int N, MPI_Comm comm) {
+    int rank, size;
+    MPI_Comm_rank(comm, &rank);
+    MPI_Comm_size(comm, &size);
+
+    vector<int> counts, displs;
+    block_partition(N, size, N, counts, displs);
+    int local_rows = counts[rank] / N;
+
+    vector<int> A, C;
+    vector<int> B(N * N);
+    vector<int> local_A(counts[rank]), local_C(counts[rank], 0);
+    if (rank == 0) {
+        A.resize(N * N);
+        C.resize(N * N);
+        for (int i = 0; i < N * N; ++i) {
+            A[i] = rand() % 10;
+            B[i] = rand() % 10;
+        }
+    }
+
+    MPI_Barrier(comm);
+    double start_time = MPI_Wtime();
+
+    MPI_Scatterv(A.data(), counts.data(), displs.data(), MPI_INT,
+                 local_A.data(), counts[rank], MPI_INT, 0, comm);
+    MPI_Bcast(B.data(), N * N, MPI_INT, 0, comm);
+
+    for (int i = 0; i < local_rows; ++i) {
+        for (int j = 0; j < N; ++j) {
+            for (int k = 0; k < N; ++k) {
+                local_C[i * N + j] += local_A[i * N + k] * B[k * N + j];
+            }
+        }
+    }
+
+    MPI_Gatherv(local_C.data(), counts[rank], MPI_INT,
+                C.data(), counts.data(), displs.data(), MPI_INT, 0, comm);
+
+    return MPI_Wtime() - start_time;
+}
+
+// Размер задачи для p процессов: при слабой масштабируемости объём работы растёт пропорционально p
+int problem_size(const string& kernel, const string& mode, int base_N, int p) {
+    if (mode == "strong") {
+        return base_N;
+    }
+    if (kernel == "matmul") {
+        // Работа умножения матриц ~ N^3
+        return static_cast<int>(lround(base_N * cbrt(static_cast<double>(p))));
+    }
+    return base_N * p;
+}
+
+// Запуск ядра на коммуникаторе, возвращается минимальное по повторам время (на ранге 0 коммуникатора)
+double run_kernel(const string& kernel, int N, MPI_Comm comm) {
+    double best_time = 0.0;
+    for (int r = 0; r < REPETITIONS; ++r) {
+        double local_time = 0.0;
+        if (kernel == "minmax") {
+            local_time = kernel_minmax(N, comm);
+        } else if (kernel == "dot") {
+            local_time = kernel_dot(N, comm);
+        } else if (kernel == "matmul") {
+            local_time = kernel_matmul(N, comm);
+        }
+
+        double time = 0.0;
+        MPI_Reduce(&local_time, &time, 1, MPI_DOUBLE, MPI_MAX, 0, comm);
+        best_time = r == 0 ? time : min(best_time, time);
+    }
+    return best_time;
+}
+
+int main(int argc, char** argv) {
+    MPI_Init(&argc, &argv);
+
+    int rank, size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank); // Получение текущего ранга процесса
+    MPI_Comm_size(MPI_COMM_WORLD, &size); // Получение общего числа процессов
+
+    // Параметры: ядро (minmax, dot, matmul, all), режим (strong, weak, both), базовый размер задачи
+    string kernel_arg = argc > 1 ? argv[1] : "all";
+    string mode_arg = argc > 2 ? argv[2] : "both";
+    int base_N_arg = argc > 3 ? atoi(argv[3]) : 0;
+
+    vector<string> kernels = {"minmax", "dot", "matmul"};
+    vector<string> modes = {"strong", "weak"};
+
+    // Проверка параметров: неизвестное ядро или режим - ошибка
+    bool known_kernel = kernel_arg == "all" || find(kernels.begin(), kernels.end(), kernel_arg) != kernels.end();
+    bool known_mode = mode_arg == "both" || find(modes.begin(), modes.end(), mode_arg) != modes.end();
+    if (!known_kernel || !known_mode) {
+        if (rank == 0) {
+            cerr << "Usage: MPI10 [minmax|dot|matmul|all] [strong|weak|both] [base_N]\n";
+        }
+        MPI_Finalize();
+        return 1;
+    }
+
+    if (kernel_arg != "all") {
+        kernels = {kernel_arg};
+    }
+    if (mode_arg != "both") {
+        modes = {mode_arg};
+    }
+
+    // Число процессов: 1, 2, 4, ... и полный размер MPI_COMM_WORLD
+    vector<int> process_counts;
+    for (int p = 1; p < size; p *= 2) {
+        process_counts.push_back(p);
+    }
+    process_counts.push_back(size);
+
+    srand(static_cast<unsigned>(time(0)) + rank);
+
+    if (rank == 0) {
+        cout << "Kernel | Scaling | Processes | Problem size | Time (s) | Speedup | Efficiency | Karp-Flatt\n";
+        cout << "------------------------------------------------------------------------------------------\n";
+    }
+
+    for (const auto& kernel : kernels) {
+        int base_N = base_N_arg > 0 ? base_N_arg : (kernel == "matmul" ? 384 : 1000000);
+
+        for (const auto& mode : modes) {
+            double base_time = 0.0;
+
+            for (int p : process_counts) {
+                // Подкоммуникатор из первых p процессов, остальные процессы в замере не участвуют
+                MPI_Comm sub_comm;
+                MPI_Comm_split(MPI_COMM_WORLD, rank < p ? 0 : MPI_UNDEFINED, rank, &sub_comm);
+
+                int N = problem_size(kernel, mode, base_N, p);
+                double time = 0.0;
+                if (sub_comm != MPI_COMM_NULL) {
+                    time = run_kernel(kernel, N, sub_comm);
+                    MPI_Comm_free(&sub_comm);
+                }
+
+                if (rank == 0) {
+                    if (p == 1) {
+                        base_time = time;
+                    }
+
+                    // При сильной масштабируемости S = T1 / Tp, при слабой - масштабированное ускорение S = p * T1 / Tp
+                    double speedup = mode == "strong" ? base_time / time : p * base_time / time;
+                    double efficiency = speedup / p;
+
+                    cout << kernel << "   | "
+                         << mode << "  | "
+                         << p << "         | "
+                         << N << "       | "
+                         << time << "  | "
+                         << speedup << "      | "
+                         << efficiency << "      | ";
+                    if (p > 1 && mode == "strong") {
+                        // Экспериментально определённая последовательная доля (метрика Карпа-Флатта);
+                        // формула предполагает фиксированный размер задачи, поэтому для слабой
+                        // масштабируемости не выводится
+                        cout << (1.0 / speedup - 1.0 / p) / (1.0 - 1.0 / p) << "\n";
+                    } else {
+                        cout << "-\n";
+                    }
+                }
+            }
+        }
+    }
+
+    MPI_Finalize();
+    return 0;
+}
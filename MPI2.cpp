@@ -4,9 +4,33 @@
 #include <cstdlib>
 #include <ctime>
 #include <numeric>
+#include <algorithm>
+#include <sys/resource.h>
 
 using namespace std;
 
+// Пиковый объём резидентной памяти процесса (КБ)
+long peak_rss_kb() {
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+// Вывод пикового объёма резидентной памяти каждого процесса
+void report_peak_rss(int rank, int size) {
+    long rss = peak_rss_kb();
+    vector<long> all_rss(size);
+    MPI_Gather(&rss, 1, MPI_LONG, all_rss.data(), 1, MPI_LONG, 0, MPI_COMM_WORLD);
+
+    if (rank == 0) {
+        cout << "\nRank | Peak RSS (MB)\n";
+        cout << "--------------------\n";
+        for (int i = 0; i < size; ++i) {
+            cout << i << "    | " << all_rss[i] / 1024.0 << "\n";
+        }
+    }
+}
+
 int main(int argc, char** argv) {
     MPI_Init(&argc, &argv);
 
@@ -14,6 +38,17 @@ int main(int argc, char** argv) {
     MPI_Comm_rank(MPI_COMM_WORLD, &rank); // Получение текущего ранга процесса
     MPI_Comm_size(MPI_COMM_WORLD, &size); // Получение общего числа процессов
     vector<int> vector_sizes = {1000, 10000, 100000, 1000000, 10000000};
+    int max_N = *max_element(vector_sizes.begin(), vector_sizes.end());
+
+    // Буферы выделяются один раз под максимальный размер и переиспользуются;
+    // полные векторы нужны только процессу 0
+    vector<int> vec1, vec2, local_vec1, local_vec2;
+    local_vec1.reserve(max_N / size);
+    local_vec2.reserve(max_N / size);
+    if (rank == 0) {
+        vec1.reserve(max_N);
+        vec2.reserve(max_N);
+    }
 
     if (rank == 0) {
         cout << "Vector size | Number of processes | Sequential time | Parallel time | Result\n";
@@ -22,9 +57,9 @@ int main(int argc, char** argv) {
 
     // Цикл по различным размерам векторов
     for (int N : vector_sizes) {
-        vector<int> vec1, vec2;
         int local_size = N / size; // Размер части вектора для каждого процесса
-        vector<int> local_vec1(local_size), local_vec2(local_size);
+        local_vec1.resize(local_size);
+        local_vec2.resize(local_size);
 
         double seq_start_time = 0.0, seq_end_time = 0.0;
         long long scalar_result_seq = 0;
@@ -71,6 +106,8 @@ int main(int argc, char** argv) {
         }
     }
 
+    report_peak_rss(rank, size);
+
     MPI_Finalize();
     return 0;
 }
@@ -6,6 +6,9 @@
 #include <chrono>
 #include <numeric>
 #include <cmath>
+#include <string>
+#include <algorithm>
+#include <sys/resource.h>
 
 using namespace std;
 
@@ -21,17 +24,40 @@ bool verify_results(const vector<int>& result1, const vector<int>& result2, int
     return true;
 }
 
-// Параллельное умножение матриц
-void matrix_multiply_parallel(const vector<int>& A, const vector<int>& B, vector<int>& C, int N, int rank, int size) {
+// Пиковый объём резидентной памяти процесса (КБ)
+long peak_rss_kb() {
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+// Вывод пикового объёма резидентной памяти каждого процесса
+void report_peak_rss(int rank, int size) {
+    long rss = peak_rss_kb();
+    vector<long> all_rss(size);
+    MPI_Gather(&rss, 1, MPI_LONG, all_rss.data(), 1, MPI_LONG, 0, MPI_COMM_WORLD);
+
+    if (rank == 0) {
+        cout << "\nRank | Peak RSS (MB)\n";
+        cout << "--------------------\n";
+        for (int i = 0; i < size; ++i) {
+            cout << i << "    | " << all_rss[i] / 1024.0 << "\n";
+        }
+    }
+}
+
+// Параллельное умножение матриц (local_A и local_C - переиспользуемые буферы процесса)
+void matrix_multiply_parallel(const vector<int>& A, vector<int>& B, vector<int>& C, int N, int rank, int size,
+                              vector<int>& local_A, vector<int>& local_C) {
     int block_size = N / size; // Размер блока для каждого процесса
-    vector<int> local_A(block_size * N);
-    vector<int> local_C(block_size * N, 0);
+    local_A.resize(block_size * N);
+    local_C.assign(block_size * N, 0);
 
     // Распределение строк матрицы A между процессами
     MPI_Scatter(A.data(), block_size * N, MPI_INT, local_A.data(), block_size * N, MPI_INT, 0, MPI_COMM_WORLD);
     
     // Широковещательная передача матрицы B всем процессам
-    MPI_Bcast(const_cast<int*>(B.data()), N * N, MPI_INT, 0, MPI_COMM_WORLD);
+    MPI_Bcast(B.data(), N * N, MPI_INT, 0, MPI_COMM_WORLD);
 
     // Локальное умножение блоков матриц
     for (int i = 0; i < block_size; ++i) {
@@ -66,13 +92,37 @@ int main(int argc, char** argv) {
     MPI_Comm_size(MPI_COMM_WORLD, &size); // Получение общего числа процессов
     vector<int> matrix_sizes = {192, 384, 768};
 
+    // Режим "lean": каждый процесс выделяет только нужные его роли буферы,
+    // память резервируется один раз под максимальный размер и переиспользуется
+    bool lean = argc > 1 && string(argv[1]) == "lean";
+    int max_N = *max_element(matrix_sizes.begin(), matrix_sizes.end());
+
+    vector<int> A, B, C_seq, C_parallel, local_A, local_C;
+    if (lean) {
+        B.reserve(max_N * max_N);
+        local_A.reserve(max_N / size * max_N);
+        local_C.reserve(max_N / size * max_N);
+        if (rank == 0) {
+            A.reserve(max_N * max_N);
+            C_seq.reserve(max_N * max_N);
+            C_parallel.reserve(max_N * max_N);
+        }
+    }
+
     if (rank == 0) {
+        cout << "Memory mode: " << (lean ? "lean" : "full") << "\n";
         cout << "Matrix size | Processes count | Parallel (s)  | Sequential (s) | Correctness\n";
         cout << "---------------------------------------------------------------------------\n";
     }
 
     for (int N : matrix_sizes) {
-        vector<int> A(N * N), B(N * N), C_seq(N * N, 0), C_parallel(N * N, 0);
+        // Страницы буферов впервые заполняются процессом-владельцем при resize/assign
+        B.assign(N * N, 0);
+        if (!lean || rank == 0) {
+            A.assign(N * N, 0);
+            C_seq.assign(N * N, 0);
+            C_parallel.assign(N * N, 0);
+        }
 
         // Инициализация матриц
         if (rank == 0) {
@@ -83,15 +133,18 @@ int main(int argc, char** argv) {
             }
         }
 
-        // Последовательное умножение матриц
-        double seq_start_time = MPI_Wtime();
-        matrix_multiply_simple(A, B, C_seq, N);
-        double seq_end_time = MPI_Wtime();
-        double seq_time = seq_end_time - seq_start_time;
+        // Последовательное умножение матриц (в режиме lean - только на процессе 0)
+        double seq_time = 0.0;
+        if (!lean || rank == 0) {
+            double seq_start_time = MPI_Wtime();
+            matrix_multiply_simple(A, B, C_seq, N);
+            double seq_end_time = MPI_Wtime();
+            seq_time = seq_end_time - seq_start_time;
+        }
 
         // Параллельное умножение матриц
         double start_time = MPI_Wtime();
-        matrix_multiply_parallel(A, B, C_parallel, N, rank, size);
+        matrix_multiply_parallel(A, B, C_parallel, N, rank, size, local_A, local_C);
         double end_time = MPI_Wtime();
         double parallel_time = end_time - start_time;
 
@@ -106,6 +159,8 @@ int main(int argc, char** argv) {
         }
     }
 
+    report_peak_rss(rank, size);
+
     MPI_Finalize();
     return 0;
 }
@@ -5,6 +5,9 @@
 #include <ctime>
 #include <chrono>
 #include <numeric>
+#include <string>
+#include <algorithm>
+#include <sys/resource.h>
 
 using namespace std;
 
@@ -18,9 +21,32 @@ bool verify_results(const vector<int>& result1, const vector<int>& result2, int
     return true;
 }
 
-// Параллельное умножение матриц
-void matrix_multiply_parallel(const vector<int>& A, const vector<int>& B, vector<int>& C,
-                              int N, int rank, int size, const string& mode) {
+// Пиковый объём резидентной памяти процесса (КБ)
+long peak_rss_kb() {
+    rusage usage;
+    getrusage(RUSAGE_SELF, &usage);
+    return usage.ru_maxrss;
+}
+
+// Вывод пикового объёма резидентной памяти каждого процесса
+void report_peak_rss(int rank, int size) {
+    long rss = peak_rss_kb();
+    vector<long> all_rss(size);
+    MPI_Gather(&rss, 1, MPI_LONG, all_rss.data(), 1, MPI_LONG, 0, MPI_COMM_WORLD);
+
+    if (rank == 0) {
+        cout << "\nRank | Peak RSS (MB)\n";
+        cout << "--------------------\n";
+        for (int i = 0; i < size; ++i) {
+            cout << i << "    | " << all_rss[i] / 1024.0 << "\n";
+        }
+    }
+}
+
+// Параллельное умножение матриц (local_A, local_C и buffer - переиспользуемые буферы процесса)
+void matrix_multiply_parallel(const vector<int>& A, vector<int>& B, vector<int>& C,
+                              int N, int rank, int size, const string& mode, bool lean,
+                              vector<int>& local_A, vector<int>& local_C, vector<char>& buffer) {
     int block_size = N / size;
 
     if (N % size != 0) {
@@ -30,13 +56,19 @@ void matrix_multiply_parallel(const vector<int>& A, const vector<int>& B, vector
         MPI_Abort(MPI_COMM_WORLD, 1);
     }
 
-    vector<int> local_A(block_size * N);
-    vector<int> local_C(block_size * N, 0);
+    local_A.resize(block_size * N);
+    local_C.assign(block_size * N, 0);
 
     int buffer_size = (block_size * N + MPI_BSEND_OVERHEAD) * sizeof(int);
-    vector<char> buffer(buffer_size * size);
+    bool attach_buffer = mode == "buffered" && size > 1 && (!lean || rank == 0);
+    if (!lean) {
+        buffer.assign(buffer_size * size, 0);
+    } else if (attach_buffer) {
+        // Буфер нужен только отправителю и только в буферизованном режиме
+        buffer.resize(buffer_size * (size - 1));
+    }
 
-    if (mode == "buffered") {
+    if (attach_buffer) {
         MPI_Buffer_attach(buffer.data(), buffer.size());
         if (rank == 0) {
             cout << "Buffer attached for mode: buffered" << endl;
@@ -60,7 +92,7 @@ void matrix_multiply_parallel(const vector<int>& A, const vector<int>& B, vector
     }
 
     // Распространение матрицы B всем процессам
-    MPI_Bcast(const_cast<int*>(B.data()), N * N, MPI_INT, 0, MPI_COMM_WORLD);
+    MPI_Bcast(B.data(), N * N, MPI_INT, 0, MPI_COMM_WORLD);
 
     // Вычисление локальной части результата
     for (int i = 0; i < block_size; ++i) {
@@ -74,7 +106,7 @@ void matrix_multiply_parallel(const vector<int>& A, const vector<int>& B, vector
     // Сборка результирующей матрицы
     MPI_Gather(local_C.data(), block_size * N, MPI_INT, C.data(), block_size * N, MPI_INT, 0, MPI_COMM_WORLD);
 
-    if (mode == "buffered") {
+    if (attach_buffer) {
         void* detach_buffer;
         int detach_buffer_size;
         MPI_Buffer_detach(&detach_buffer, &detach_buffer_size);
@@ -106,14 +138,43 @@ int main(int argc, char** argv) {
     vector<int> matrix_sizes = {192, 384, 768};
     vector<string> modes = {"sync", "ready", "buffered"};
 
+    // Режим "lean": каждый процесс выделяет только нужные его роли буферы,
+    // память резервируется один раз под максимальный размер и переиспользуется
+    bool lean = argc > 1 && string(argv[1]) == "lean";
+    int max_N = *max_element(matrix_sizes.begin(), matrix_sizes.end());
+
+    vector<int> A, B, C_seq, C_parallel, local_A, local_C;
+    vector<char> buffer;
+    if (lean) {
+        B.reserve(max_N * max_N);
+        local_A.reserve(max_N / size * max_N);
+        local_C.reserve(max_N / size * max_N);
+        if (rank == 0) {
+            A.reserve(max_N * max_N);
+            C_seq.reserve(max_N * max_N);
+            C_parallel.reserve(max_N * max_N);
+        }
+        // Буфер для MPI_Bsend нужен только процессу 0 и только при наличии получателей
+        if (rank == 0 && size > 1) {
+            buffer.reserve((max_N / size * max_N + MPI_BSEND_OVERHEAD) * sizeof(int) * (size - 1));
+        }
+    }
+
     if (rank == 0) {
+        cout << "Memory mode: " << (lean ? "lean" : "full") << "\n";
         cout << "Matrix Size | Transfer Mode | Number of Processes | Execution Time (sec) | Correctness\n";
         cout << "----------------------------------------------------------------------------------------\n";
     }
 
     for (int N : matrix_sizes) {
         for (const auto& mode : modes) {
-            vector<int> A(N * N), B(N * N), C_seq(N * N, 0), C_parallel(N * N, 0);
+            // Страницы буферов впервые заполняются процессом-владельцем при assign
+            B.assign(N * N, 0);
+            if (!lean || rank == 0) {
+                A.assign(N * N, 0);
+                C_seq.assign(N * N, 0);
+                C_parallel.assign(N * N, 0);
+            }
 
             if (rank == 0) {
                 srand(static_cast<unsigned>(time(0)));
@@ -126,7 +187,7 @@ int main(int argc, char** argv) {
             }
 
             auto start_time = chrono::high_resolution_clock::now();
-            matrix_multiply_parallel(A, B, C_parallel, N, rank, size, mode);
+            matrix_multiply_parallel(A, B, C_parallel, N, rank, size, mode, lean, local_A, local_C, buffer);
             auto end_time = chrono::high_resolution_clock::now();
             chrono::duration<double> parallel_duration = end_time - start_time;
             double parallel_time = parallel_duration.count();
@@ -140,6 +201,8 @@ int main(int argc, char** argv) {
         }
     }
 
+    report_peak_rss(rank, size);
+
     MPI_Finalize();
     return 0;
 }
@@ -0,0 +1,256 @@
+#include <mpi.h>
+#include <iostream>
+#include <vector>
+#include <string>
+#include <random>
+#include <algorithm>
+#include <cstdlib>
+#include <unistd.h>
+
+using namespace std;
+
+constexpr int TAG_REQUEST = 1; // Запрос очередной порции задач от рабочего процесса
+constexpr int TAG_CHUNK = 2;   // Ответ планировщика: {первая задача, количество задач}
+
+// Функция, имитирующая вычисления с задержкой
+void do_computations(int delay_time_us) {
+    usleep(delay_time_us);
+}
+
+// Генерация длительностей задач (мкс) по заданному распределению со средним mean_us
+vector<int> generate_tasks(const string& distribution, int num_tasks, int mean_us, unsigned seed) {
+    mt19937 gen(seed);
+    vector<int> tasks(num_tasks);
+
+    for (int i = 0; i < num_tasks; ++i) {
+        double value = mean_us;
+        if (distribution == "uniform") {
+            value = uniform_real_distribution<double>(0.0, 2.0 * mean_us)(gen);
+        } else if (distribution == "exponential") {
+            value = exponential_distribution<double>(1.0 / mean_us)(gen);
+        } else if (distribution == "bimodal") {
+            // 10% "тяжёлых" задач в 5.5 раз длиннее среднего, остальные в 2 раза короче
+            value = bernoulli_distribution(0.1)(gen) ? 5.5 * mean_us : 0.5 * mean_us;
+        }
+        tasks[i] = max(1, static_cast<int>(value));
+    }
+    return tasks;
+}
+
+// Размер очередной порции задач для заданной стратегии
+int next_chunk_size(const string& policy, int remaining, int workers, int& batch_left, int& batch_chunk) {
+    if (policy == "guided") {
+        // Guided self-scheduling: порция = остаток / число рабочих. Из-за предварительного
+        // запроса у каждого рабочего на руках до двух порций, поэтому делитель удвоен
+        return max(1, (remaining + 2 * workers - 1) / (2 * workers));
+    }
+    // Factoring: пакет из workers одинаковых порций, каждая по половине остатка / число рабочих
+    if (batch_left == 0) {
+        batch_chunk = max(1, (remaining + 2 * workers - 1) / (2 * workers));
+        batch_left = workers;
+    }
+    --batch_left;
+    return batch_chunk;
+}
+
+// Планировщик (ранг 0): раздаёт порции задач по запросу, пока они не закончатся
+void run_scheduler(const string& policy, int num_tasks, int workers, int& chunks_sent, double& scheduler_time) {
+    int next_task = 0;
+    int finished_workers = 0;
+    int batch_left = 0, batch_chunk = 0;
+    chunks_sent = 0;
+    scheduler_time = 0.0;
+
+    while (finished_workers < workers) {
+        MPI_Status status;
+        int dummy;
+        MPI_Recv(&dummy, 1, MPI_INT, MPI_ANY_SOURCE, TAG_REQUEST, MPI_COMM_WORLD, &status);
+
+        double service_start = MPI_Wtime();
+        int chunk[2] = {next_task, 0};
+        int remaining = num_tasks - next_task;
+        if (remaining > 0) {
+            chunk[1] = min(remaining, next_chunk_size(policy, remaining, workers, batch_left, batch_chunk));
+            next_task += chunk[1];
+            ++chunks_sent;
+        } else {
+            ++finished_workers; // Пустая порция - сигнал завершения
+        }
+        MPI_Send(chunk, 2, MPI_INT, status.MPI_SOURCE, TAG_CHUNK, MPI_COMM_WORLD);
+        scheduler_time += MPI_Wtime() - service_start;
+    }
+}
+
+// Рабочий процесс: запрос следующей порции отправляется до начала вычисления текущей,
+// поэтому ответ планировщика приходит, пока процесс занят полезной работой
+void run_worker(const vector<int>& tasks, double& busy_time, double& wait_time) {
+    int dummy = 0;
+    int chunk[2], next_chunk[2];
+    busy_time = 0.0;
+    wait_time = 0.0;
+
+    double wait_start = MPI_Wtime();
+    MPI_Send(&dummy, 1, MPI_INT, 0, TAG_REQUEST, MPI_COMM_WORLD);
+    MPI_Recv(chunk, 2, MPI_INT, 0, TAG_CHUNK, MPI_COMM_WORLD, MPI_STATUS_IGNORE);
+    wait_time += MPI_Wtime() - wait_start;
+
+    while (chunk[1] > 0) {
+        // Предварительный запрос следующей порции
+        MPI_Request requests[2];
+        MPI_Isend(&dummy, 1, MPI_INT, 0, TAG_REQUEST, MPI_COMM_WORLD, &requests[0]);
+        MPI_Irecv(next_chunk, 2, MPI_INT, 0, TAG_CHUNK, MPI_COMM_WORLD, &requests[1]);
+
+        double compute_start = MPI_Wtime();
+        for (int t = chunk[0]; t < chunk[0] + chunk[1]; ++t) {
+            do_computations(tasks[t]);
+        }
+        busy_time += MPI_Wtime() - compute_start;
+
+        wait_start = MPI_Wtime();
+        MPI_Waitall(2, requests, MPI_STATUSES_IGNORE);
+        wait_time += MPI_Wtime() - wait_start;
+
+        chunk[0] = next_chunk[0];
+        chunk[1] = next_chunk[1];
+    }
+}
+
+// Статическое разбиение: каждый рабочий процесс получает непрерывный блок задач
+void run_static(const vector<int>& tasks, int rank, int workers, double& busy_time) {
+    int num_tasks = tasks.size();
+    int worker = rank - 1;
+    int begin = static_cast<long long>(num_tasks) * worker / workers;
+    int end = static_cast<long long>(num_tasks) * (worker + 1) / workers;
+
+    double compute_start = MPI_Wtime();
+    for (int t = begin; t < end; ++t) {
+        do_computations(tasks[t]);
+    }
+    busy_time = MPI_Wtime() - compute_start;
+}
+
+int main(int argc, char** argv) {
+    MPI_Init(&argc, &argv);
+
+    int rank, size;
+    MPI_Comm_rank(MPI_COMM_WORLD, &rank); // Получение текущего ранга процесса
+    MPI_Comm_size(MPI_COMM_WORLD, &size); // Получение общего числа процессов
+
+    // Ранг 0 - планировщик, остальные процессы - рабочие
+    if (size < 2) {
+        if (rank == 0) {
+            cerr << "The program must be run with at least 2 processes.\n";
+        }
+        MPI_Finalize();
+        return 1;
+    }
+
+    // Параметры: число задач, средняя длительность задачи (мкс), распределение длительностей
+    int num_tasks = argc > 1 ? atoi(argv[1]) : 400;
+    int mean_task_us = argc > 2 ? atoi(argv[2]) : 2000;
+    string distribution_arg = argc > 3 ? argv[3] : "all";
+
+    vector<string> distributions = {"uniform", "exponential", "bimodal"};
+
+    // Проверка параметров: неизвестное распределение или некорректные числа - ошибка
+    bool known_distribution = distribution_arg == "all" ||
+        find(distributions.begin(), distributions.end(), distribution_arg) != distributions.end();
+    if (num_tasks <= 0 || mean_task_us <= 0 || !known_distribution) {
+        if (rank == 0) {
+            cerr << "Usage: MPI9 [num_tasks > 0] [mean_task_us > 0] [uniform|exponential|bimodal|all]\n";
+        }
+        MPI_Finalize();
+        return 1;
+    }
+
+    if (distribution_arg != "all") {
+        distributions = {distribution_arg};
+    }
+    vector<string> policies = {"static", "guided", "factoring"};
+    int workers = size - 1;
+
+    if (rank == 0) {
+        cout << "Tasks: " << num_tasks << ", mean task time (us): " << mean_task_us
+             << ", workers: " << workers << "\n";
+        cout << "Distribution | Policy    | Chunks | Makespan (s) | Ideal (s) | Speedup vs static | Util min/avg/max | Avg wait (s) | Scheduler (s)\n";
+        cout << "----------------------------------------------------------------------------------------------------------------------------\n";
+    }
+
+    for (const auto& distribution : distributions) {
+        // Длительности задач генерируются на ранге 0 и рассылаются всем процессам
+        vector<int> tasks(num_tasks);
+        if (rank == 0) {
+            tasks = generate_tasks(distribution, num_tasks, mean_task_us, 12345);
+        }
+        MPI_Bcast(tasks.data(), num_tasks, MPI_INT, 0, MPI_COMM_WORLD);
+
+        long long total_work_us = 0;
+        for (int t : tasks) {
+            total_work_us += t;
+        }
+        double ideal_time = total_work_us * 1e-6 / workers;
+        double static_makespan = 0.0;
+
+        for (const auto& policy : policies) {
+            double busy_time = 0.0, wait_time = 0.0, scheduler_time = 0.0;
+            int chunks_sent = 0;
+
+            MPI_Barrier(MPI_COMM_WORLD); // Синхронизация процессов перед началом измерений
+            double start_time = MPI_Wtime();
+
+            if (policy == "static") {
+                if (rank != 0) {
+                    run_static(tasks, rank, workers, busy_time);
+                }
+                chunks_sent = workers;
+            } else if (rank == 0) {
+                run_scheduler(policy, num_tasks, workers, chunks_sent, scheduler_time);
+            } else {
+                run_worker(tasks, busy_time, wait_time);
+            }
+
+            double local_time = MPI_Wtime() - start_time;
+            double makespan = 0.0;
+            MPI_Reduce(&local_time, &makespan, 1, MPI_DOUBLE, MPI_MAX, 0, MPI_COMM_WORLD);
+
+            // Сбор времени полезной работы и ожидания со всех процессов
+            vector<double> busy_times(size), wait_times(size);
+            MPI_Gather(&busy_time, 1, MPI_DOUBLE, busy_times.data(), 1, MPI_DOUBLE, 0, MPI_COMM_WORLD);
+            MPI_Gather(&wait_time, 1, MPI_DOUBLE, wait_times.data(), 1, MPI_DOUBLE, 0, MPI_COMM_WORLD);
+
+            if (rank == 0) {
+                if (policy == "static") {
+                    static_makespan = makespan;
+                }
+
+                double util_min = 1.0, util_max = 0.0, util_sum = 0.0, wait_sum = 0.0;
+                for (int w = 1; w < size; ++w) {
+                    double util = busy_times[w] / makespan;
+                    util_min = min(util_min, util);
+                    util_max = max(util_max, util);
+                    util_sum += util;
+                    wait_sum += wait_times[w];
+                }
+
+                cout << distribution << "      | "
+                     << policy << "    | "
+                     << chunks_sent << "     | "
+                     << makespan << "     | "
+                     << ideal_time << "  | "
+                     << static_makespan / makespan << "           | "
+                     << util_min << "/" << util_sum / workers << "/" << util_max << " | "
+                     << wait_sum / workers << "     | "
+                     << scheduler_time << "\n";
+
+                cout << "  per-worker utilization:";
+                for (int w = 1; w < size; ++w) {
+                    cout << " " << w << "=" << busy_times[w] / makespan;
+                }
+                cout << "\n";
+            }
+        }
+    }
+
+    MPI_Finalize();
+    return 0;
+}